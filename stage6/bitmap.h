@@ -0,0 +1,185 @@
+#ifndef BITMAP_H
+#define BITMAP_H
+
+#include <stdint.h>
+#include <map>
+#include "catalog.h"
+
+// upper bound on the slot numbers of a page: every record takes a slot
+// and at least one byte of the page
+const int MAXSLOTS = 256;
+
+// A compressed set of tuple positions. The tuple with RID rid is at
+// position rid.pageNo * MAXSLOTS + rid.slotNo, so positions are dense
+// for the pages of a heap file.
+//
+// The positions are split into chunks of 2^16 on their high 16 bits, as
+// in a roaring bitmap. A chunk holding at most ARRAYMAX positions keeps
+// their low 16 bits in a sorted array; a fuller one is a plain bitset
+// of 2^16 bits. Bitmaps are intersected and united chunk by chunk, two
+// bitsets a 64-bit word at a time in loops the compiler can vectorize.
+
+class Bitmap {
+public:
+  // position of a RID and back
+  static unsigned int position(const RID &rid);
+  static RID rid(const unsigned int pos);
+
+  // add a position
+  void add(const unsigned int pos);
+
+  // remove a position; returns false if it was not in the set
+  bool remove(const unsigned int pos);
+
+  // number of positions in the set
+  const int count() const;
+
+  // keep only the positions also in other
+  void intersect(const Bitmap &other);
+
+  // add all positions of other
+  void unite(const Bitmap &other);
+
+  // append the RIDs of all positions in increasing order, which is
+  // the order of the tuples in the heap file
+  void getRIDs(vector<RID> &rids) const;
+
+  // append the bitmap to out in a form read back by deserialize
+  void serialize(vector<char> &out) const;
+
+  // read a bitmap written by serialize from data, advancing data;
+  // returns BADINDEXPARM if it runs past end
+  const Status deserialize(const char *&data, const char *end);
+
+private:
+  struct Chunk {
+    unsigned short key;           // high 16 bits of its positions
+    int card;                     // number of positions in the chunk
+    vector<unsigned short> array; // low 16 bits if card <= ARRAYMAX
+    vector<uint64_t> bits;        // bitset otherwise
+  };
+
+  // chunk with the given key, created empty if create is set and
+  // there is none; NULL if there is none
+  Chunk *findChunk(const unsigned short key, const bool create);
+
+  static void toBitset(Chunk &chunk);
+  static void toArray(Chunk &chunk);
+  static void intersectChunk(Chunk &chunk, const Chunk &other);
+  static void uniteChunk(Chunk &chunk, const Chunk &other);
+
+  vector<Chunk> chunks; // non-empty chunks in key order
+};
+
+// Header page of a bitmap index file (the first page of the file).
+
+struct BitmapHdrPage {
+  char relName[MAXNAME];  // relation indexed
+  char attrName[MAXNAME]; // attribute indexed
+  int attrOffset;         // offset of attribute in tuple
+  int attrType;           // INTEGER, FLOAT, or STRING
+  int attrLen;            // length of attribute (= length of key)
+  int valueCnt;           // number of distinct values
+  int byteCnt;            // length of the stored directory
+  int firstPage;          // first page holding it, -1 if none
+};
+
+// The directory of the index is stored as a byte stream of <key,
+// firstPage, byteCnt> entries, one per distinct value, and the bitmap
+// of each value as a byte stream of its own at firstPage. Every byte
+// stream is cut into a chain of pages.
+
+struct BitmapDataPage {
+  int nextPage; // next page of the chain, -1 for the last
+  char data[PAGESIZE - sizeof(int)];
+};
+
+// A bitmap index on one attribute of a relation, holding for every
+// distinct value of the attribute the bitmap of the tuples having that
+// value. It suits attributes with few distinct values, for which a
+// selection becomes a handful of bitmap operations and, when only the
+// number of tuples or the selection attribute itself is wanted, never
+// has to read the relation.
+//
+// The directory of the values is read into memory when the index is
+// opened, and the bitmap of a value only when an operation needs it.
+// When the index is closed, the bitmaps that have changed are written
+// back to its file (see fileName()), a page only if its bytes differ,
+// and so is the directory if it has changed.
+
+class BitmapIndex {
+public:
+  // open the index on relation.attrName
+  BitmapIndex(const string &relation, const string &attrName,
+              Status &status);
+
+  // write back the bitmaps and close the index
+  ~BitmapIndex();
+
+  // create an empty index on the attribute described by attr
+  static const Status create(const AttrDesc &attr);
+
+  // destroy the index on relation.attrName
+  static const Status destroy(const string &relation, const string &attrName);
+
+  // name of the file holding the index on relation.attrName
+  static const string fileName(const string &relation,
+                               const string &attrName);
+
+  // add the tuple with the given key at rid
+  const Status insertEntry(const void *key, const RID &rid);
+
+  // remove the tuple with the given key at rid; returns RECNOTFOUND if
+  // it is not there
+  const Status deleteEntry(const void *key, const RID &rid);
+
+  // set result to the bitmap of the tuples whose attribute value
+  // satisfies (value) op (filter)
+  const Status select(const Operator op, const void *filter,
+                      Bitmap &result);
+
+  // return number of distinct values in index
+  const int getValueCnt() const;
+
+  // write the changed bitmaps back to the index file
+  const Status flush();
+
+private:
+  // the bitmap of a distinct value and where it is stored
+  struct Value {
+    int firstPage; // first page of the stored bitmap, -1 if none
+    int byteCnt;   // length of the stored bitmap
+    bool loaded;   // true if bitmap has been read in
+    bool dirty;    // true if bitmap has been updated since
+    Bitmap bitmap;
+  };
+
+  // read in the bitmap of value unless it already is
+  const Status load(Value &value);
+
+  // read the byteCnt bytes of the page chain at firstPage into bytes
+  const Status readChain(const int firstPage, const int byteCnt,
+                         vector<char> &bytes);
+
+  // store bytes in the page chain at firstPage, which may move
+  const Status writeChain(int &firstPage, const vector<char> &bytes);
+
+  // copy a key into the fixed-length key format, with the bytes after
+  // the end of a string and the sign of a zero float cleared
+  void copyKey(char *dest, const void *key) const;
+
+  int compareKeys(const void *key1, const void *key2) const;
+
+  File *filePtr;             // underlying DB File object
+  BitmapHdrPage *headerPage; // pinned index header page
+  int headerPageNo;          // page number of header page
+  bool hdrDirtyFlag;         // true if header page has been updated
+  bool dirtyFlag;            // true if directory has been updated
+
+  int keyLen;       // length of key
+  Datatype keyType; // type of key
+
+  map<string, Value> values; // every distinct key and its bitmap
+};
+
+#endif
@@ -0,0 +1,185 @@
+#ifndef BTREE_H
+#define BTREE_H
+
+#include "catalog.h"
+#include "sort.h"
+
+// percentage of a node filled by a bulk load unless told otherwise
+const int BTREEFILLFACTOR = 90;
+
+// max. number of attributes included in the leaf entries of an index
+const int MAXINCLUDE = 8;
+
+// Header page of a B+-tree index file (the first page of the file).
+
+struct BTreeHdrPage {
+  char relName[MAXNAME];  // relation indexed
+  char attrName[MAXNAME]; // attribute indexed
+  int attrOffset;         // offset of attribute in tuple
+  int attrType;           // INTEGER, FLOAT, or STRING
+  int attrLen;            // length of attribute (= length of key)
+  int rootPage;           // page number of root node
+  int height;             // number of levels in tree, 1 if root is a leaf
+  int entryCnt;           // number of entries in index
+  int includeCnt;         // number of included attributes
+  int includeOffset[MAXINCLUDE]; // offset of included attribute in tuple
+  int includeLen[MAXINCLUDE];    // length of included attribute
+};
+
+// Layout of a B+-tree node page.
+//
+// A leaf holds keyCnt entries of the form <key, rid, included>, where
+// included is the concatenated values of the included attributes of
+// the tuple (nothing for an index without any). An interior node holds
+// a leading child page number followed by keyCnt entries of the form
+// <key, rid, child>, where child is the subtree holding entries greater
+// than or equal to <key, rid>. Fields inside entries are not aligned
+// and are accessed with memcpy.
+
+struct BTreeNode {
+  int level;    // 0 for leaves, height - 1 for the root
+  int keyCnt;   // number of entries on the node
+  int nextPage; // right sibling of a leaf, -1 for the last leaf
+  char entries[PAGESIZE - 3 * sizeof(int)];
+};
+
+// A B+-tree secondary index on one attribute of a relation. The index
+// lives in its own DB file (see fileName()) and all of its pages are
+// accessed through the buffer manager.
+//
+// Every entry is ordered by its key first and its RID second, so that
+// entries with duplicate keys still have a unique position in the tree
+// and a given <key, rid> can be found again for deletion.
+//
+// The leaf entries may carry copies of other attributes of the tuple
+// (INCLUDE attributes). A query needing only the key and included
+// attributes can then be answered from the leaves alone, without
+// fetching any tuple from the relation; see covers().
+//
+// Deletion is lazy: entries are removed from their leaf, but nodes are
+// never merged or redistributed and a leaf that becomes empty stays in
+// the leaf chain. Scans simply step over empty leaves.
+
+class BTreeIndex {
+public:
+  // open the index on relation.attrName
+  BTreeIndex(const string &relation, const string &attrName, Status &status);
+
+  // close the index
+  ~BTreeIndex();
+
+  // create an empty index on the attribute described by attr whose
+  // leaf entries carry the attributes in includes
+  static const Status create(const AttrDesc &attr,
+                             const vector<AttrDesc> &includes);
+
+  // destroy the index on relation.attrName
+  static const Status destroy(const string &relation, const string &attrName);
+
+  // name of the file holding the index on relation.attrName
+  static const string fileName(const string &relation,
+                               const string &attrName);
+
+  // add entry <key, rid> for tuple, which supplies the included
+  // attributes
+  const Status insertEntry(const void *key, const RID &rid,
+                           const char *tuple);
+
+  // remove entry <key, rid>; returns RECNOTFOUND if there is none
+  const Status deleteEntry(const void *key, const RID &rid);
+
+  // start a scan of the entries with lowKey <(=) key <(=) highKey.
+  // A NULL bound leaves the range open on that side.
+  const Status startScan(const void *lowKey, const bool lowInclusive,
+                         const void *highKey, const bool highInclusive);
+
+  // return RID of next entry in range; NOMORERECS when done
+  const Status scanNext(RID &outRid);
+
+  // same, also returning the entry itself, which stays valid until
+  // the scan moves on
+  const Status scanNext(RID &outRid, const char *&entry);
+
+  // terminate the scan
+  const Status endScan();
+
+  // build the tree bottom-up from the entryCnt <key, rid, included>
+  // records returned by sorted, filling nodes to fillFactor percent
+  const Status bulkLoad(SortedFile &sorted, const int entryCnt,
+                        const int fillFactor);
+
+  // return number of entries in index
+  const int getEntryCnt() const;
+
+  // return number of levels in the tree
+  const int getHeight() const;
+
+  // true if the entries hold the value of attr, found at entryOffset
+  // within an entry returned by scanNext
+  const bool covers(const AttrDesc &attr, int &entryOffset) const;
+
+private:
+  // copy a key supplied by the caller into the fixed-length key format
+  void copyKey(char *dest, const void *key) const;
+
+  int compareKeys(const void *key1, const void *key2) const;
+  int compareEntries(const char *entry1, const char *entry2) const;
+
+  // position on node of the first entry >= entry
+  int findPosition(const BTreeNode *node, const char *entry) const;
+
+  // child of an interior node to descend into to find entry
+  int findChild(const BTreeNode *node, const char *entry) const;
+
+  char *leafEntry(BTreeNode *node, const int pos) const;
+  char *interiorEntry(BTreeNode *node, const int pos) const;
+  int getChild(BTreeNode *node, const int pos) const;
+  void setChild(BTreeNode *node, const int pos, const int child) const;
+
+  // insert entry into the subtree rooted at pageNo. If the node
+  // splits, the new right sibling is returned in newPageNo (-1
+  // otherwise) and the entry separating the two in sepEntry.
+  const Status insertInto(const int pageNo, const char *entry, int &newPageNo,
+                          char *sepEntry);
+
+  const Status insertLeaf(const int pageNo, BTreeNode *node,
+                          const char *entry, int &newPageNo, char *sepEntry);
+
+  const Status insertInterior(const int pageNo, BTreeNode *node,
+                              const int childPos, const char *childSep,
+                              const int childPageNo, int &newPageNo,
+                              char *sepEntry);
+
+  // turn one level of a bulk-loaded tree (children, and the entry
+  // separating children[i] from its left neighbour at seps[i]) into the
+  // level above it, writing the new nodes through batch
+  const Status buildLevel(vector<int> &children, vector<char> &seps,
+                          const int level, const int fillFactor, Page *batch);
+
+  // descend to the leaf that would hold entry (the leftmost leaf if
+  // entry is NULL) and leave it pinned
+  const Status findLeaf(const char *entry, int &pageNo, BTreeNode *&leaf);
+
+  File *filePtr;            // underlying DB File object
+  BTreeHdrPage *headerPage; // pinned index header page
+  int headerPageNo;         // page number of header page
+  bool hdrDirtyFlag;        // true if header page has been updated
+
+  int keyLen;           // length of key
+  Datatype keyType;     // type of key
+  int sepLen;           // size of <key, rid>
+  int leafEntryLen;     // size of <key, rid, included>
+  int interiorEntryLen; // size of <key, rid, child>
+  int leafCap;          // max. number of entries on a leaf
+  int interiorCap;      // max. number of entries on an interior node
+
+  // state of the current scan
+  BTreeNode *curLeaf; // pinned leaf, NULL if no scan in progress
+  int curLeafNo;      // page number of pinned leaf
+  int curPos;         // position of next entry on leaf
+  char highBound[MAXSTRINGLEN]; // upper bound of scan
+  bool highBounded;             // false if scan has no upper bound
+  bool highInclusive;           // true if upper bound is inclusive
+};
+
+#endif
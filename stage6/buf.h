@@ -1,6 +1,7 @@
 #ifndef BUF_H
 #define BUF_H
 
+#include <mutex>
 #include "db.h"
 // define if debug output wanted
 // #define DEBUGBUF
@@ -91,7 +92,9 @@ private:
   BufHashTbl *hashTable; // hash table mapping (File, page) to frame
   BufDesc *bufTable;     // vector of status info, 1 per page
   BufStats bufStats;     // buffer pool statistics
+  mutex latch;           // serializes access from concurrent scans
 
+  // the following private methods assume the caller holds latch
   const Status allocBuf(int &frame); // allocate a free frame.
   const void releaseBuf(int frame);  // return unused frame to end of list
   void advanceClock() { clockHand = (clockHand + 1) % numBufs; }
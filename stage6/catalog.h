@@ -1,15 +1,19 @@
 #ifndef CATALOG_H
 #define CATALOG_H
 
+#include <cstddef>
+#include <unordered_map>
 #include "heapfile.h"
 
 // define if debug output wanted
 // #define DEBUGCAT
 
-#define RELCATNAME "relcat"   // name of relation catalog
-#define ATTRCATNAME "attrcat" // name of attribute catalog
-#define MAXNAME 32            // length of relName, attrName
-#define MAXSTRINGLEN 255      // max. length of string attribute
+#define RELCATNAME "relcat"     // name of relation catalog
+#define ATTRCATNAME "attrcat"   // name of attribute catalog
+#define STATCATNAME "statcat"   // name of statistics catalog
+#define INDEXCATNAME "indexcat" // name of index catalog
+#define MAXNAME 32              // length of relName, attrName
+#define MAXSTRINGLEN 255        // max. length of string attribute
 
 // schema of relation catalog:
 //   relation name : char(32)           <-- lookup key
@@ -49,11 +53,39 @@ public:
   // destroy a relation
   const Status destroyRel(const string &relation);
 
+  // build a B+-tree index on an attribute of a relation, filling its
+  // nodes to fillFactor percent; the leaf entries also carry the
+  // values of the attributes named in includeNames
+  const Status addIndex(const string &relation, const string &attrName,
+                        const int fillFactor,
+                        const vector<string> &includeNames = vector<string>());
+
+  // build a hash index with nbuckets buckets on an attribute
+  const Status addHashIndex(const string &relation, const string &attrName,
+                            const int nbuckets);
+
+  // build a bitmap index on an attribute
+  const Status addBitmapIndex(const string &relation, const string &attrName);
+
+  // change the number of buckets of the hash index on an attribute
+  const Status resizeHashIndex(const string &relation,
+                               const string &attrName, const int nbuckets);
+
+  // drop the indices on an attribute, or all indices of the relation
+  // if attrName is empty
+  const Status dropIndex(const string &relation, const string &attrName);
+
   // print catalog information
   const Status help(const string &relation); // relation may be NULL
 
   // get rid of catalog
   ~RelCatalog();
+
+private:
+  // in-memory copy of relcat, keyed by relation name. It is loaded
+  // when the catalog is opened and kept in step by addInfo() and
+  // removeInfo(), so lookups never touch the buffer pool.
+  unordered_map<string, RelDesc> relCache;
 };
 
 // schema of attribute catalog:
@@ -63,14 +95,66 @@ public:
 //   attribute type : integer(4)  (type is Datatype actually)
 //   attribute size : integer(4)
 
+// kinds of index on an attribute (bits of AttrDesc.indexed)
+const int BTREEINDEX = 1;
+const int HASHINDEX = 2;
+const int BITMAPINDEX = 4;
+
 typedef struct {
   char relName[MAXNAME];  // relation name
   char attrName[MAXNAME]; // attribute name
   int attrOffset;         // attribute offset
   int attrType;           // attribute type
   int attrLen;            // attribute length
+  int indexed;            // kinds of index on attribute, 0 if none
 } AttrDesc;
 
+// length of an attrcat tuple: indexed is kept in indexcat, so that
+// the tuples are the same as in databases made before there were
+// indices
+const int ATTRCATRECLEN = offsetof(AttrDesc, indexed);
+
+// schema of index catalog, which holds a tuple per attribute with an
+// index:
+//   relation name : char(32)           <-- lookup keys
+//   attribute name : char(32)          <--
+//   indexed : integer(4)
+
+typedef struct {
+  char relName[MAXNAME];  // relation name
+  char attrName[MAXNAME]; // attribute name
+  int indexed;            // kinds of index on attribute
+} IndexDesc;
+
+// schema of statistics catalog, holding the statistics gathered by
+// analyze on an attribute:
+//   relation name : char(32)           <-- lookup keys
+//   attribute name : char(32)          <--
+//   tuple count, page count : integer(4)
+//   distinct count, bucket count : integer(4)
+//   min, max and histogram bounds : char(16) each
+//
+// Values are kept in the binary form of the attribute, strings cut to
+// STATKEYLEN bytes. The histogram is equi-depth: bucket i holds about
+// tupleCnt / bucketCnt tuples, with values from bounds[i] (exclusive,
+// except for the first bucket) to bounds[i + 1]. statcat is not itself
+// described in relcat and attrcat.
+
+const int STATKEYLEN = 16;
+const int HISTBUCKETS = 10;
+
+typedef struct {
+  char relName[MAXNAME];                    // relation name
+  char attrName[MAXNAME];                   // attribute name
+  int tupleCnt;                             // tuples in relation
+  int pageCnt;                              // pages in relation
+  int distinctCnt;                          // estimated distinct values
+  int bucketCnt;                            // histogram buckets used
+  char minValue[STATKEYLEN];                // smallest value
+  char maxValue[STATKEYLEN];                // largest value
+  char bounds[HISTBUCKETS + 1][STATKEYLEN]; // histogram bucket bounds
+} AttrStats;
+
 class AttrCatalog : public HeapFile {
   friend class RelCatalog;
 
@@ -95,8 +179,40 @@ public:
   // delete all information about a relation
   const Status dropRelation(const string &relation);
 
+  // record the kinds of index that exist on an attribute
+  const Status setIndexed(const string &relation, const string &attrName,
+                          const int indexed);
+
+  // get the statistics on an attribute; NOSTATS if it was never
+  // analyzed
+  const Status getStats(const string &relation, const string &attrName,
+                        AttrStats &record);
+
+  // store the statistics on an attribute, replacing any older ones
+  const Status setStats(AttrStats &record);
+
+  // remove the statistics on all attributes of a relation
+  const Status removeStats(const string &relation);
+
   // close attribute catalog
   ~AttrCatalog();
+
+private:
+  // add a tuple to the in-memory copy of attrcat
+  void cacheInfo(const AttrDesc &record);
+
+  // record the kinds of index on an attribute in the in-memory copy
+  void cacheIndexed(const string &relation, const string &attrName,
+                    const int indexed);
+
+  // in-memory copy of attrcat, kept in step by addInfo() and
+  // removeInfo(): the attributes of each relation in catalog order,
+  // and every attribute keyed by "relation.attribute"
+  unordered_map<string, vector<AttrDesc>> relAttrCache;
+  unordered_map<string, AttrDesc> attrCache;
+
+  // in-memory copy of statcat, keyed by "relation.attribute"
+  unordered_map<string, AttrStats> statsCache;
 };
 
 extern RelCatalog *relCat;
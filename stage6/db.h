@@ -3,6 +3,7 @@
 
 #include <sys/types.h>
 #include <functional>
+#include <mutex>
 #include "error.h"
 #include <string.h>
 using namespace std;
@@ -22,11 +23,15 @@ class File {
 
 public:
   Status allocatePage(int &pageNo);           // allocate a new page
+  Status allocatePages(const int count,
+                       int &firstPageNo);     // allocate contiguous pages
   const Status disposePage(const int pageNo); // release space for a page
   const Status readPage(const int pageNo,
                         Page *pagePtr) const; // read page from file
   const Status writePage(const int pageNo,
-                         const Page *pagePtr);  // write page to file
+                         const Page *pagePtr); // write page to file
+  const Status writePages(const int pageNo, const Page *pages,
+                          const int count);     // write consecutive pages
   const Status getFirstPage(int &pageNo) const; // returns pageNo of first page
 
   bool operator==(const File &other) const {
@@ -55,6 +60,7 @@ private:
   string fileName; // The name of the file
   int openCnt;     // # times file has been opened
   int unixFile;    // unix file stream for file
+  mutex spaceLatch; // serializes page allocation and disposal
 };
 
 class BufMgr;
@@ -79,6 +79,7 @@ enum Status {
   NOINDEX,
   INDEXEXISTS,
   ATTRTOOLONG,
+  NOSTATS,
 
   // Utility errors
 
@@ -86,6 +87,10 @@ enum Status {
 
   ATTRTYPEMISMATCH,
   TMP_RES_EXISTS,
+  NOTCONNECTED,
+  TOOMANYRELS,
+  NOTGROUPED,
+  SUMOVERFLOW,
 
   // do not touch filler -- add codes before it
 
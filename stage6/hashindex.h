@@ -0,0 +1,155 @@
+#ifndef HASHINDEX_H
+#define HASHINDEX_H
+
+#include "catalog.h"
+
+// number of directory entries held by one directory page
+const int DIRPERPAGE = PAGESIZE / sizeof(int);
+
+// bounds on the size of the directory: at most 2^MAXGLOBALDEPTH
+// entries, spread over at most MAXDIRPAGES pages
+const int MAXGLOBALDEPTH = 15;
+const int MAXDIRPAGES = (1 << MAXGLOBALDEPTH) / DIRPERPAGE;
+
+// Header page of a hash index file (the first page of the file).
+
+struct HashHdrPage {
+  char relName[MAXNAME];  // relation indexed
+  char attrName[MAXNAME]; // attribute indexed
+  int attrOffset;         // offset of attribute in tuple
+  int attrType;           // INTEGER, FLOAT, or STRING
+  int attrLen;            // length of attribute (= length of key)
+  int globalDepth;        // directory has 2^globalDepth entries
+  int entryCnt;           // number of entries in index
+  int dirPageCnt;         // number of directory pages in use
+  int dirPages[MAXDIRPAGES]; // page numbers of the directory pages
+};
+
+// Layout of a bucket page. A bucket is a primary page followed by a
+// chain of overflow pages, all holding keyCnt entries of the form
+// <key, rid>. Fields inside entries are not aligned and are accessed
+// with memcpy.
+
+struct HashBucket {
+  int localDepth;   // number of hash bits shared by keys of the bucket
+  int keyCnt;       // number of entries on the page
+  int overflowPage; // next page of the bucket, -1 if none
+  char entries[PAGESIZE - 3 * sizeof(int)];
+};
+
+// An extendible hash index on one attribute of a relation. The index
+// lives in its own DB file (see fileName()) and all of its pages are
+// accessed through the buffer manager.
+//
+// A key is hashed to 32 bits, the low globalDepth bits of which select
+// a directory entry, and the directory entry names the primary page of
+// the bucket holding the key. An equality lookup therefore reads one
+// directory page and one bucket page. When a bucket fills up it is
+// split in two on the next hash bit, doubling the directory if the
+// bucket already uses all globalDepth bits; no other bucket is touched.
+// Overflow pages are only chained onto a bucket when splitting cannot
+// help, i.e. all of its keys hash to the same value or the directory
+// has reached its maximum size.
+//
+// Deletion is lazy: entries are removed from their page, but buckets
+// are never merged and empty overflow pages stay in their chain.
+
+class HashIndex {
+public:
+  // open the index on relation.attrName
+  HashIndex(const string &relation, const string &attrName, Status &status);
+
+  // close the index
+  ~HashIndex();
+
+  // create an empty index with at least nbuckets buckets on the
+  // attribute described by attr
+  static const Status create(const AttrDesc &attr, const int nbuckets);
+
+  // destroy the index on relation.attrName
+  static const Status destroy(const string &relation, const string &attrName);
+
+  // name of the file holding the index on relation.attrName
+  static const string fileName(const string &relation,
+                               const string &attrName);
+
+  // add entry <key, rid>
+  const Status insertEntry(const void *key, const RID &rid);
+
+  // remove entry <key, rid>; returns RECNOTFOUND if there is none
+  const Status deleteEntry(const void *key, const RID &rid);
+
+  // split or merge buckets so that there are nbuckets of them
+  const Status resize(const int nbuckets);
+
+  // start a scan of the entries with the given key
+  const Status startScan(const void *key);
+
+  // return RID of next entry with the key; NOMORERECS when done
+  const Status scanNext(RID &outRid);
+
+  // terminate the scan
+  const Status endScan();
+
+  // return number of entries in index
+  const int getEntryCnt() const;
+
+private:
+  // copy a key supplied by the caller into the fixed-length key format
+  void copyKey(char *dest, const void *key) const;
+
+  int compareKeys(const void *key1, const void *key2) const;
+  unsigned int hashKey(const void *key) const;
+
+  char *entryAt(HashBucket *bucket, const int pos) const;
+
+  // read and write directory entry dirNo
+  const Status getDirEntry(const int dirNo, int &pageNo);
+  const Status setDirEntry(const int dirNo, const int pageNo);
+
+  // double and halve the directory
+  const Status growDirectory();
+  const Status shrinkDirectory();
+
+  // add entry to the bucket whose primary page is pageNo, chaining
+  // on an overflow page if the bucket is full
+  const Status addToBucket(const int pageNo, const char *entry);
+
+  // look at the bucket of entry: fails with NONUNIQUEENTRY if the
+  // entry is there already, otherwise tells whether the bucket is
+  // full and whether all of its keys share the entry's hash value
+  const Status probeBucket(const int pageNo, const char *entry,
+                           const unsigned int hash, int &localDepth,
+                           bool &full, bool &sameHash);
+
+  // split the bucket with primary page pageNo, whose directory entries
+  // include dirNo, on hash bit localDepth
+  const Status splitBucket(const int pageNo, const int dirNo);
+
+  // merge the bucket with primary page pageNo into the bucket with
+  // primary page buddyNo; dirNo is a directory entry of pageNo
+  const Status mergeBuckets(const int buddyNo, const int pageNo,
+                            const int dirNo);
+
+  // pull all entries out of a bucket, leaving it empty and without
+  // overflow pages
+  const Status emptyBucket(const int pageNo, vector<char> &entries);
+
+  File *filePtr;           // underlying DB File object
+  HashHdrPage *headerPage; // pinned index header page
+  int headerPageNo;        // page number of header page
+  bool hdrDirtyFlag;       // true if header page has been updated
+
+  int keyLen;      // length of key
+  Datatype keyType; // type of key
+  int entryLen;    // size of <key, rid>
+  int bucketCap;   // max. number of entries on a bucket page
+
+  // state of the current scan
+  HashBucket *curPage;       // pinned bucket page, NULL if no scan
+  int curPageNo;             // page number of pinned page
+  int curPos;                // position of next entry on page
+  char scanKey[MAXSTRINGLEN]; // key being looked up
+};
+
+#endif
@@ -5,6 +5,8 @@
 #include <functional>
 #include <iostream>
 #include <vector>
+#include <mutex>
+#include <condition_variable>
 #include <string.h>
 #include <assert.h>
 #include "stdlib.h"
@@ -34,6 +36,8 @@ struct FileHdrPage {
 
 // class definition of heapFile
 class HeapFile {
+  friend class PageChain;
+
 protected:
   File *filePtr;           // underlying DB File object
   FileHdrPage *headerPage; // pinned file header page in buffer pool
@@ -55,6 +59,9 @@ public:
   // return number of records in file
   const int getRecCnt() const;
 
+  // return number of data pages in file
+  const int getPageCnt() const;
+
   // given a RID, read record from file, returning pointer and length
   const Status getRecord(const RID &rid, Record &rec);
 };
@@ -83,9 +90,23 @@ public:
   // delete current record
   const Status deleteRecord();
 
+  // delete all records satisfying the scan, a page at a time;
+  // returns the number of records deleted in delCnt. If given,
+  // onDelete is called for each record once it is off its page.
+  const Status
+  deleteMatching(int &delCnt,
+                 const function<Status(const Record &, const RID &)> &onDelete =
+                     nullptr);
+
+  // position the scan just before the first record on data page pageNo
+  const Status seekPage(const int pageNo);
+
   // marks current page of scan dirty
   const Status markDirty();
 
+protected:
+  const bool matchRec(const Record &rec) const;
+
 private:
   int offset;         // byte offset of filter attribute
   int length;         // length of filter attribute
@@ -99,8 +120,81 @@ private:
   // scan to be rolled back to the following
   int markedPageNo; // page number of pinned page
   RID markedRec;    // rid of last record returned
+};
 
-  const bool matchRec(const Record &rec) const;
+// A filtered scan whose data pages are handed out one at a time to
+// several worker threads. Each worker claims the next unclaimed page
+// of the chain, evaluates the scan predicate against the records on
+// it with matchRec(), and releases the page when done. Pages are
+// numbered in chain order so that callers can reassemble per-page
+// results in file order. The next page of the chain is only known
+// once a page has been read, so the pages are read one after another,
+// but without holding the latch: while one worker reads a page, the
+// others work on theirs.
+
+class ParallelHeapFileScan : public HeapFileScan {
+public:
+  ParallelHeapFileScan(const string &name, Status &status);
+
+  // pin the next unclaimed data page; returns FILEEOF past the last page
+  const Status claimPage(int &seqNo, int &pageNo, Page *&page);
+
+  // unpin a page obtained from claimPage()
+  const Status releasePage(const int pageNo);
+
+  // true if rec satisfies the predicate given to startScan()
+  using HeapFileScan::matchRec;
+
+private:
+  mutex latch;                   // protects the cursor fields below
+  condition_variable cursorMoved; // signalled when reading is cleared
+  bool reading;                   // nextPageNo awaits the page read
+  int nextPageNo;                 // next page of the chain to hand out
+  int nextSeqNo;                  // chain position of nextPageNo
+};
+
+// number of pages a PageChain fills in memory before writing them out
+const int BULKBATCH = 32;
+
+// A PageChain packs records into freshly allocated, fully formatted
+// data pages. The pages are built in private memory, bypassing the
+// buffer pool, and written to the file BULKBATCH pages at a time.
+// The result is a linked chain of pages (firstPage .. lastPage) that
+// does not belong to the heap file until it is handed to
+// InsertFileScan::appendChain().
+
+class PageChain {
+public:
+  PageChain(const HeapFile &heapFile);
+  ~PageChain();
+
+  // add record to the chain, returning its RID
+  const Status insertRecord(const Record &rec, RID &outRid);
+
+  // write out the pages still in memory. The last page of the chain
+  // is made to point at nextPageNo.
+  const Status seal(const int nextPageNo);
+
+  // seal this chain so that it continues with the (already sealed)
+  // pages of tail, and take those pages over
+  const Status concat(const PageChain &tail);
+
+  // give all pages of the chain back to the file, for a chain that
+  // will not be appended after all
+  const Status discard();
+
+  int firstPage; // first page of the chain, -1 if chain is empty
+  int lastPage;  // last page of the chain
+  int pageCnt;   // number of pages in the chain
+  int recCnt;    // number of records in the chain
+
+private:
+  const Status newBatch(); // reserve page numbers for the next batch
+
+  File *filePtr;  // file the pages belong to
+  Page *batch;    // pages currently being filled
+  int batchFirst; // page number of batch[0]
+  int batchUsed;  // number of pages of batch in use
 };
 
 class InsertFileScan : public HeapFile {
@@ -112,6 +206,13 @@ public:
 
   // insert record into file, returning its RID
   const Status insertRecord(const Record &rec, RID &outRid);
+
+  // delete the record just inserted at rid, which is on the current
+  // page
+  const Status deleteRecord(const RID &rid);
+
+  // link a sealed PageChain onto the end of the file
+  const Status appendChain(const PageChain &chain);
 };
 
 #endif
@@ -0,0 +1,39 @@
+#ifndef INDEX_H
+#define INDEX_H
+
+#include "bitmap.h"
+#include "btree.h"
+#include "hashindex.h"
+
+// The indices defined on one relation, opened together. Operators that
+// modify a relation use it to keep all of its indices up to date
+// without consulting the catalog for every tuple.
+
+class RelIndexes {
+public:
+  // open all indices on relation
+  RelIndexes(const string &relation, Status &status);
+
+  // close the indices
+  ~RelIndexes();
+
+  // true if the relation has no indices
+  const bool empty() const;
+
+  // add the index entries for tuple rec stored at rid; if that fails,
+  // none of them is left behind
+  const Status insertEntries(const Record &rec, const RID &rid);
+
+  // remove the index entries for tuple rec stored at rid
+  const Status deleteEntries(const Record &rec, const RID &rid);
+
+private:
+  vector<AttrDesc> attrs;        // attributes with a B+-tree
+  vector<BTreeIndex *> btrees;   // B+-tree on attrs[i]
+  vector<AttrDesc> hashAttrs;    // attributes with a hash index
+  vector<HashIndex *> hashes;    // hash index on hashAttrs[i]
+  vector<AttrDesc> bitmapAttrs;  // attributes with a bitmap index
+  vector<BitmapIndex *> bitmaps; // bitmap index on bitmapAttrs[i]
+};
+
+#endif
@@ -59,6 +59,9 @@ public:
   // delete the record with the specified rid
   const Status deleteRecord(const RID &rid);
 
+  // delete the ridCnt records listed in rids, compacting the page once
+  const Status deleteRecords(const RID rids[], const int ridCnt);
+
   // returns RID of first record on page
   // returns  NORECORDS if page contains no records.  Otherwise, returns OK
   const Status firstRecord(RID &firstRid) const;
@@ -47,13 +47,18 @@ typedef enum {
   N_CREATE,
   N_DESTROY,
   N_BUILD,
+  N_BUILDBITMAP,
   N_REBUILD,
   N_DROP,
   N_LOAD,
+  N_ANALYZE,
   N_PRINT,
   N_HELP,
   N_SELECT,
   N_JOIN,
+  N_BOOL,
+  N_ORDER,
+  N_AGGR,
   N_PRIMATTR,
   N_QUALATTR,
   N_ATTRVAL,
@@ -63,6 +68,9 @@ typedef enum {
   N_ALIAS
 } NODEKIND;
 
+// ways of combining the conditions of a BOOL node
+typedef enum { B_AND, B_OR } BOOLOP;
+
 //
 // structure of parse tree nodes
 //
@@ -76,6 +84,9 @@ typedef struct node {
       char *relname;
       struct node *attrlist;
       struct node *qual;
+      struct node *grouplist; // attributes grouped on, NULL if none
+      struct node *order;     // ORDER node, NULL if unordered
+      int distinct;           // whether duplicates are eliminated
     } QUERY;
 
     // insert node */
@@ -107,6 +118,8 @@ typedef struct node {
       char *relname;
       char *attrname;
       int nbuckets;
+      int fillfactor;
+      struct node *includelist;
     } BUILD;
 
     // drop node */
@@ -118,9 +131,15 @@ typedef struct node {
     // load node */
     struct {
       char *relname;
-      char *filename;
+      struct node *filelist;
+      int analyze; // gather statistics after loading
     } LOAD;
 
+    // analyze node */
+    struct {
+      char *relname;
+    } ANALYZE;
+
     // pprint node */
     struct {
       char *relname;
@@ -145,10 +164,17 @@ typedef struct node {
       struct node *joinattr2;
     } JOIN;
 
+    // conditions combined by AND or OR */
+    struct {
+      int op; // B_AND or B_OR
+      struct node *quallist;
+    } BOOL;
+
     // qualified attribute node */
     struct {
       char *relname;
       char *attrname;
+      char *alias; // alias of the relation in the query, NULL if none
     } QUALATTR;
 
     // primary attribute node */
@@ -186,6 +212,19 @@ typedef struct node {
       } u;
     } VALUE;
 
+    // order by node */
+    struct {
+      struct node *orderattr;
+      int descending; // largest value first
+      int limit;      // number of tuples wanted, -1 for all
+    } ORDER;
+
+    // aggregate node */
+    struct {
+      int func;              // AggrFunc applied
+      struct node *aggrattr; // QUALATTR node, no attrname for COUNT(*)
+    } AGGR;
+
     // list node */
     struct {
       struct node *self;
@@ -205,19 +244,26 @@ typedef struct node {
 //
 
 NODE *newnode(int kind);
-NODE *query_node(char *relname, NODE *attrlist, NODE *n);
+NODE *query_node(char *relname, NODE *attrlist, NODE *n, NODE *grouplist,
+                 NODE *order, int distinct);
 NODE *insert_node(char *relname, NODE *attrlist);
 NODE *delete_node(char *relname, NODE *qual);
 NODE *create_node(char *relname, NODE *attrlist, NODE *primattr);
 NODE *destroy_node(char *relname);
-NODE *build_node(char *relname, char *attrname, int nbuckets);
+NODE *build_node(char *relname, char *attrname, int nbuckets,
+                 int fillfactor, NODE *includelist);
+NODE *bitmap_node(char *relname, char *attrname);
 NODE *rebuild_node(char *relname, char *attrname, int nbuckets);
 NODE *drop_node(char *relname, char *attrname);
-NODE *load_node(char *relname, char *filename);
+NODE *load_node(char *relname, NODE *filelist, int analyze);
+NODE *analyze_node(char *relname);
 NODE *print_node(char *relname);
 NODE *help_node(char *relname);
 NODE *select_node(NODE *selattr, int op, NODE *value);
 NODE *join_node(NODE *joinattr1, int op, NODE *joinattr2);
+NODE *bool_node(int op, NODE *quallist);
+NODE *order_node(NODE *orderattr, int descending, int limit);
+NODE *aggr_node(int func, NODE *aggrattr);
 NODE *qualattr_node(char *relname, char *attrname);
 NODE *primattr_node(char *attrname, int nbuckets);
 NODE *attrval_node(char *attrname, NODE *value);
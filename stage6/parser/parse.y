@@ -6,6 +6,8 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include "heapfile.h"
+#include "catalog.h"
+#include "query.h"
 #include "parse.h"
 
 extern "C" int isatty(int);
@@ -34,6 +36,7 @@ static NODE *parse_tree;                // root of parse tree
 		RW_DESTROY
 		RW_PRINT
 		RW_LOAD
+		RW_ANALYZE
 		RW_HELP
 		RW_QUIT
 		RW_SELECT
@@ -43,6 +46,9 @@ static NODE *parse_tree;                // root of parse tree
 		RW_DELETE
 		RW_PRIMARY
 		RW_NUMBUCKETS
+		RW_FILLFACTOR
+		RW_INCLUDE
+		RW_BITMAP
 		RW_ALL
 		RW_FROM
 		RW_AS
@@ -51,6 +57,18 @@ static NODE *parse_tree;                // root of parse tree
 		RW_OR
 		RW_NOT
 		RW_VALUES	
+		RW_ORDER
+		RW_BY
+		RW_ASC
+		RW_DESC
+		RW_LIMIT
+		RW_GROUP
+		RW_COUNT
+		RW_SUM
+		RW_AVG
+		RW_MIN
+		RW_MAX
+		RW_DISTINCT
 		INT_TYPE
 		REAL_TYPE
 		CHAR_TYPE	
@@ -73,10 +91,17 @@ static NODE *parse_tree;                // root of parse tree
 		T_SHELL_CMD
 
 %type	<ival>	op
+		opt_fillfactor
+		opt_descending
+		opt_limit
+		aggr_func
+		opt_distinct
 
 %type	<sval>	opt_into_relname
 		opt_relname
 		string
+		name
+		bare_name
 
 %type	<n>	command
 		query
@@ -85,21 +110,30 @@ static NODE *parse_tree;                // root of parse tree
 		create
 		destroy
 		build
-/*
 		rebuild
-*/
 		drop
 		load
+		analyze
+		filename_list
 		print
 		help
 		quit
 		opt_primary_attr
+		opt_include
 		opt_where
+		opt_group
+		opt_order
 		qual
+		condition
+		conjunction
+		disjunction
 		selection
 		join
 		non_mt_qualattr_list
 		qualattr
+		non_mt_selattr_list
+		selattr
+		aggregate
 /*
 		non_mt_attrval_list
 		attrval
@@ -148,11 +182,10 @@ command
 	| create
 	| destroy
 	| build
-/*
 	| rebuild
-*/
 	| drop
 	| load
+	| analyze
 	| print
 	| help
 	| quit
@@ -163,21 +196,30 @@ command
 	;
 
 query
-	: RW_SELECT non_mt_qualattr_list opt_into_relname RW_FROM table_list opt_where
+	: RW_SELECT opt_distinct non_mt_selattr_list opt_into_relname RW_FROM
+	  table_list opt_where opt_group opt_order
 /*	RW_SELECT opt_into_relname '(' non_mt_qualattr_list ')' opt_where */
 	{
 		NODE *where;
-		NODE *qualattr_list = replace_alias_in_qualattr_list($5, $2);
+		NODE *qualattr_list = replace_alias_in_qualattr_list($6, $3);
 		if (qualattr_list == NULL) { // something wrong in qualattr_list
 		  $$ = NULL;
 		}
 		else {
-		  where = replace_alias_in_condition($5, $6);
-		  if ((where == NULL) && ($6 != NULL)) {
+		  where = replace_alias_in_condition($6, $7);
+		  if ((where == NULL) && ($7 != NULL)) {
 		     $$ = NULL; //something wrong in where condition
 		  }
+		  else if ($8 != NULL &&
+		           replace_alias_in_qualattr_list($6, $8) == NULL) {
+		     $$ = NULL; //something wrong in group by attributes
+		  }
+		  else if ($9 != NULL && replace_alias_in_qualattr_list($6,
+		             list_node($9->u.ORDER.orderattr)) == NULL) {
+		     $$ = NULL; //something wrong in order by attribute
+		  }
 		  else {
-		    $$ = query_node($3, qualattr_list, where);
+		    $$ = query_node($4, qualattr_list, where, $8, $9, $2);
 		  }
 		}
 	}
@@ -227,7 +269,7 @@ attrib_list
 	}
 
 attrib
-	: string
+	: name
 	{
 		$$ = attrval_node($1, NULL);
 	}
@@ -270,23 +312,25 @@ destroy
 	;
 
 build
-	: RW_BUILD string '(' string ')'
+	: RW_BUILD string '(' name ')' opt_include opt_fillfactor
+	{
+		$$ = build_node($2, $4, 0, $7, $6);
+	}
+	| RW_BUILD string '(' name ')' RW_BITMAP
 	{
-		$$ = build_node($2, $4, 0);
+		$$ = bitmap_node($2, $4);
 	}
 	;
 
-/*
 rebuild
-	: RW_REBUILD string '(' string ')' RW_NUMBUCKETS T_EQ T_INT
+	: RW_REBUILD string '(' name ')' RW_NUMBUCKETS T_EQ T_INT
 	{
 		$$ = rebuild_node($2, $4, $8);
 	}
 	;
-*/
 
 drop
-	: RW_DROP string '(' string ')'
+	: RW_DROP string '(' name ')'
 	{
 		$$ = drop_node($2, $4);
 	}
@@ -297,9 +341,35 @@ drop
 	;
 
 load
-	: RW_LOAD RW_TABLE string RW_FROM '(' T_QSTRING ')'
+	: RW_LOAD RW_TABLE string RW_FROM '(' filename_list ')'
 	{
-		$$ = load_node($3, $6);
+		$$ = load_node($3, $6, 0);
+	}
+	| RW_LOAD RW_TABLE string RW_FROM '(' filename_list ')' RW_ANALYZE
+	{
+		$$ = load_node($3, $6, 1);
+	}
+	;
+
+analyze
+	: RW_ANALYZE string
+	{
+		$$ = analyze_node($2);
+	}
+	| RW_ANALYZE RW_TABLE string
+	{
+		$$ = analyze_node($3);
+	}
+	;
+
+filename_list
+	: T_QSTRING ',' filename_list
+	{
+		$$ = prepend(string_node($1), $3);
+	}
+	| T_QSTRING
+	{
+		$$ = list_node(string_node($1));
 	}
 	;
 print
@@ -324,7 +394,7 @@ quit
 	;
 
 opt_primary_attr
-	: RW_PRIMARY string RW_NUMBUCKETS T_EQ T_INT
+	: RW_PRIMARY name RW_NUMBUCKETS T_EQ T_INT
 	{
 		$$ = primattr_node($2, $5);
 	}
@@ -334,6 +404,87 @@ opt_primary_attr
 	}
 	;
 
+opt_include
+	: RW_INCLUDE '(' attrib_list ')'
+	{
+		$$ = $3;
+	}
+	| nothing
+	{
+		$$ = NULL;
+	}
+	;
+
+opt_fillfactor
+	: RW_FILLFACTOR T_EQ T_INT
+	{
+		$$ = $3;
+	}
+	| nothing
+	{
+		$$ = 0;
+	}
+	;
+
+opt_distinct
+	: RW_DISTINCT
+	{
+		$$ = 1;
+	}
+	| nothing
+	{
+		$$ = 0;
+	}
+	;
+
+opt_group
+	: RW_GROUP RW_BY non_mt_qualattr_list
+	{
+		$$ = $3;
+	}
+	| nothing
+	{
+		$$ = NULL;
+	}
+	;
+
+opt_order
+	: RW_ORDER RW_BY qualattr opt_descending opt_limit
+	{
+		$$ = order_node($3, $4, $5);
+	}
+	| nothing
+	{
+		$$ = NULL;
+	}
+	;
+
+opt_descending
+	: RW_DESC
+	{
+		$$ = 1;
+	}
+	| RW_ASC
+	{
+		$$ = 0;
+	}
+	| nothing
+	{
+		$$ = 0;
+	}
+	;
+
+opt_limit
+	: RW_LIMIT T_INT
+	{
+		$$ = $2;
+	}
+	| nothing
+	{
+		$$ = -1;
+	}
+	;
+
 opt_into_relname
 	: RW_INTO string
 	{
@@ -368,10 +519,44 @@ opt_where
 	;
 
 qual
+	: condition
+	| conjunction
+	{
+		$$ = bool_node(B_AND, $1);
+	}
+	| disjunction
+	{
+		$$ = bool_node(B_OR, $1);
+	}
+	;
+
+condition
 	: selection
 	| join
 	;
 
+conjunction
+	: condition RW_AND conjunction
+	{
+		$$ = prepend($1, $3);
+	}
+	| condition RW_AND condition
+	{
+		$$ = prepend($1, list_node($3));
+	}
+	;
+
+disjunction
+	: condition RW_OR disjunction
+	{
+		$$ = prepend($1, $3);
+	}
+	| condition RW_OR condition
+	{
+		$$ = prepend($1, list_node($3));
+	}
+	;
+
 selection
 	: qualattr op value
 	{
@@ -401,12 +586,66 @@ non_mt_qualattr_list
 	}
 	;
 
+non_mt_selattr_list
+	: '(' non_mt_selattr_list ')'
+	{
+		$$ = $2;
+	}
+	| selattr ',' non_mt_selattr_list
+	{
+		$$ = prepend($1, $3);
+	}
+	| selattr
+	{
+		$$ = list_node($1);
+	}
+	;
+
+selattr
+	: qualattr
+	| aggregate
+	;
+
+aggregate
+	: RW_COUNT '(' '*' ')'
+	{
+		$$ = aggr_node(CountAggr, qualattr_node(NULL, NULL));
+	}
+	| RW_COUNT '(' qualattr ')'
+	{
+		$$ = aggr_node(CountAggr, $3);
+	}
+	| aggr_func '(' qualattr ')'
+	{
+		$$ = aggr_node($1, $3);
+	}
+	;
+
+aggr_func
+	: RW_SUM
+	{
+		$$ = SumAggr;
+	}
+	| RW_AVG
+	{
+		$$ = AvgAggr;
+	}
+	| RW_MIN
+	{
+		$$ = MinAggr;
+	}
+	| RW_MAX
+	{
+		$$ = MaxAggr;
+	}
+	;
+
 qualattr
-	: string '.' string
+	: string '.' name
 	{
 		$$ = qualattr_node($1, $3);
 	}
-	| string
+	| bare_name
 	{
 		$$ = qualattr_node(NULL, $1);
 	}
@@ -442,19 +681,19 @@ non_mt_attrtype_list
 	;
 
 attrtype
-	: string INT_TYPE
+	: name INT_TYPE
  	{
 		$$ = attrtype_node($1, 'i'-128);
 	}
-	| string REAL_TYPE
+	| name REAL_TYPE
 	{
 		$$ = attrtype_node($1, 'f'-128);
 	}
-	| string CHAR_TYPE '(' value ')'
+	| name CHAR_TYPE '(' value ')'
 	{
 	 	$$ = attrtype_node($1, $4->u.VALUE.u.ival);
 	}
-	| string CHAR_TYPE
+	| name CHAR_TYPE
 	{
 		$$ = attrtype_node($1, 2);
 	}
@@ -509,6 +748,85 @@ string
 	}
 	;
 
+/*
+ * The words below became keywords after relations could have been
+ * created with attributes of these names, so they still name an
+ * attribute wherever no keyword is expected. The scanner keeps their
+ * text. An unqualified attribute cannot be called distinct, which
+ * could also follow select.
+ */
+name
+	: bare_name
+	| RW_DISTINCT
+	{
+		$$ = $<sval>1;
+	}
+	;
+
+bare_name
+	: string
+	| RW_ANALYZE
+	{
+		$$ = $<sval>1;
+	}
+	| RW_FILLFACTOR
+	{
+		$$ = $<sval>1;
+	}
+	| RW_INCLUDE
+	{
+		$$ = $<sval>1;
+	}
+	| RW_BITMAP
+	{
+		$$ = $<sval>1;
+	}
+	| RW_ORDER
+	{
+		$$ = $<sval>1;
+	}
+	| RW_BY
+	{
+		$$ = $<sval>1;
+	}
+	| RW_ASC
+	{
+		$$ = $<sval>1;
+	}
+	| RW_DESC
+	{
+		$$ = $<sval>1;
+	}
+	| RW_LIMIT
+	{
+		$$ = $<sval>1;
+	}
+	| RW_GROUP
+	{
+		$$ = $<sval>1;
+	}
+	| RW_COUNT
+	{
+		$$ = $<sval>1;
+	}
+	| RW_SUM
+	{
+		$$ = $<sval>1;
+	}
+	| RW_AVG
+	{
+		$$ = $<sval>1;
+	}
+	| RW_MIN
+	{
+		$$ = $<sval>1;
+	}
+	| RW_MAX
+	{
+		$$ = $<sval>1;
+	}
+	;
+
 nothing
 	: /* epsilon */
 	;
@@ -60,39 +60,55 @@ enum yytokentype {
   RW_DESTROY = 262,    /* RW_DESTROY  */
   RW_PRINT = 263,      /* RW_PRINT  */
   RW_LOAD = 264,       /* RW_LOAD  */
-  RW_HELP = 265,       /* RW_HELP  */
-  RW_QUIT = 266,       /* RW_QUIT  */
-  RW_SELECT = 267,     /* RW_SELECT  */
-  RW_INTO = 268,       /* RW_INTO  */
-  RW_WHERE = 269,      /* RW_WHERE  */
-  RW_INSERT = 270,     /* RW_INSERT  */
-  RW_DELETE = 271,     /* RW_DELETE  */
-  RW_PRIMARY = 272,    /* RW_PRIMARY  */
-  RW_NUMBUCKETS = 273, /* RW_NUMBUCKETS  */
-  RW_ALL = 274,        /* RW_ALL  */
-  RW_FROM = 275,       /* RW_FROM  */
-  RW_AS = 276,         /* RW_AS  */
-  RW_TABLE = 277,      /* RW_TABLE  */
-  RW_AND = 278,        /* RW_AND  */
-  RW_OR = 279,         /* RW_OR  */
-  RW_NOT = 280,        /* RW_NOT  */
-  RW_VALUES = 281,     /* RW_VALUES  */
-  INT_TYPE = 282,      /* INT_TYPE  */
-  REAL_TYPE = 283,     /* REAL_TYPE  */
-  CHAR_TYPE = 284,     /* CHAR_TYPE  */
-  T_EQ = 285,          /* T_EQ  */
-  T_LT = 286,          /* T_LT  */
-  T_LE = 287,          /* T_LE  */
-  T_GT = 288,          /* T_GT  */
-  T_GE = 289,          /* T_GE  */
-  T_NE = 290,          /* T_NE  */
-  T_EOF = 291,         /* T_EOF  */
-  NOTOKEN = 292,       /* NOTOKEN  */
-  T_INT = 293,         /* T_INT  */
-  T_REAL = 294,        /* T_REAL  */
-  T_STRING = 295,      /* T_STRING  */
-  T_QSTRING = 296,     /* T_QSTRING  */
-  T_SHELL_CMD = 297    /* T_SHELL_CMD  */
+  RW_ANALYZE = 265,    /* RW_ANALYZE  */
+  RW_HELP = 266,       /* RW_HELP  */
+  RW_QUIT = 267,       /* RW_QUIT  */
+  RW_SELECT = 268,     /* RW_SELECT  */
+  RW_INTO = 269,       /* RW_INTO  */
+  RW_WHERE = 270,      /* RW_WHERE  */
+  RW_INSERT = 271,     /* RW_INSERT  */
+  RW_DELETE = 272,     /* RW_DELETE  */
+  RW_PRIMARY = 273,    /* RW_PRIMARY  */
+  RW_NUMBUCKETS = 274, /* RW_NUMBUCKETS  */
+  RW_FILLFACTOR = 275, /* RW_FILLFACTOR  */
+  RW_INCLUDE = 276,    /* RW_INCLUDE  */
+  RW_BITMAP = 277,     /* RW_BITMAP  */
+  RW_ALL = 278,        /* RW_ALL  */
+  RW_FROM = 279,       /* RW_FROM  */
+  RW_AS = 280,         /* RW_AS  */
+  RW_TABLE = 281,      /* RW_TABLE  */
+  RW_AND = 282,        /* RW_AND  */
+  RW_OR = 283,         /* RW_OR  */
+  RW_NOT = 284,        /* RW_NOT  */
+  RW_VALUES = 285,     /* RW_VALUES  */
+  RW_ORDER = 286,      /* RW_ORDER  */
+  RW_BY = 287,         /* RW_BY  */
+  RW_ASC = 288,        /* RW_ASC  */
+  RW_DESC = 289,       /* RW_DESC  */
+  RW_LIMIT = 290,      /* RW_LIMIT  */
+  RW_GROUP = 291,      /* RW_GROUP  */
+  RW_COUNT = 292,      /* RW_COUNT  */
+  RW_SUM = 293,        /* RW_SUM  */
+  RW_AVG = 294,        /* RW_AVG  */
+  RW_MIN = 295,        /* RW_MIN  */
+  RW_MAX = 296,        /* RW_MAX  */
+  RW_DISTINCT = 297,   /* RW_DISTINCT  */
+  INT_TYPE = 298,      /* INT_TYPE  */
+  REAL_TYPE = 299,     /* REAL_TYPE  */
+  CHAR_TYPE = 300,     /* CHAR_TYPE  */
+  T_EQ = 301,          /* T_EQ  */
+  T_LT = 302,          /* T_LT  */
+  T_LE = 303,          /* T_LE  */
+  T_GT = 304,          /* T_GT  */
+  T_GE = 305,          /* T_GE  */
+  T_NE = 306,          /* T_NE  */
+  T_EOF = 307,         /* T_EOF  */
+  NOTOKEN = 308,       /* NOTOKEN  */
+  T_INT = 309,         /* T_INT  */
+  T_REAL = 310,        /* T_REAL  */
+  T_STRING = 311,      /* T_STRING  */
+  T_QSTRING = 312,     /* T_QSTRING  */
+  T_SHELL_CMD = 313    /* T_SHELL_CMD  */
 };
 typedef enum yytokentype yytoken_kind_t;
 #endif
@@ -108,39 +124,55 @@ typedef enum yytokentype yytoken_kind_t;
 #define RW_DESTROY 262
 #define RW_PRINT 263
 #define RW_LOAD 264
-#define RW_HELP 265
-#define RW_QUIT 266
-#define RW_SELECT 267
-#define RW_INTO 268
-#define RW_WHERE 269
-#define RW_INSERT 270
-#define RW_DELETE 271
-#define RW_PRIMARY 272
-#define RW_NUMBUCKETS 273
-#define RW_ALL 274
-#define RW_FROM 275
-#define RW_AS 276
-#define RW_TABLE 277
-#define RW_AND 278
-#define RW_OR 279
-#define RW_NOT 280
-#define RW_VALUES 281
-#define INT_TYPE 282
-#define REAL_TYPE 283
-#define CHAR_TYPE 284
-#define T_EQ 285
-#define T_LT 286
-#define T_LE 287
-#define T_GT 288
-#define T_GE 289
-#define T_NE 290
-#define T_EOF 291
-#define NOTOKEN 292
-#define T_INT 293
-#define T_REAL 294
-#define T_STRING 295
-#define T_QSTRING 296
-#define T_SHELL_CMD 297
+#define RW_ANALYZE 265
+#define RW_HELP 266
+#define RW_QUIT 267
+#define RW_SELECT 268
+#define RW_INTO 269
+#define RW_WHERE 270
+#define RW_INSERT 271
+#define RW_DELETE 272
+#define RW_PRIMARY 273
+#define RW_NUMBUCKETS 274
+#define RW_FILLFACTOR 275
+#define RW_INCLUDE 276
+#define RW_BITMAP 277
+#define RW_ALL 278
+#define RW_FROM 279
+#define RW_AS 280
+#define RW_TABLE 281
+#define RW_AND 282
+#define RW_OR 283
+#define RW_NOT 284
+#define RW_VALUES 285
+#define RW_ORDER 286
+#define RW_BY 287
+#define RW_ASC 288
+#define RW_DESC 289
+#define RW_LIMIT 290
+#define RW_GROUP 291
+#define RW_COUNT 292
+#define RW_SUM 293
+#define RW_AVG 294
+#define RW_MIN 295
+#define RW_MAX 296
+#define RW_DISTINCT 297
+#define INT_TYPE 298
+#define REAL_TYPE 299
+#define CHAR_TYPE 300
+#define T_EQ 301
+#define T_LT 302
+#define T_LE 303
+#define T_GT 304
+#define T_GE 305
+#define T_NE 306
+#define T_EOF 307
+#define NOTOKEN 308
+#define T_INT 309
+#define T_REAL 310
+#define T_STRING 311
+#define T_QSTRING 312
+#define T_SHELL_CMD 313
 
 /* Value type.  */
 #if !defined YYSTYPE && !defined YYSTYPE_IS_DECLARED
@@ -2,6 +2,7 @@
 #define PARTITION_H
 
 #include "heapfile.h"
+#include "spill.h"
 
 // define if debug output wanted
 // #define DEBUGPART
@@ -13,13 +14,13 @@ public:
             const int P,            // number of partitions
             const int (*hashfcn)(const Record &rec, const int P),
             // hash function to use in partitioning
-            string *&partName, // names of partitioned heap files
-            Status &status);   // create partitions of file
-  ~Partition();                // destroy partitions
+            SpillFile **&parts, // spill files holding partitions
+            Status &status);    // create partitions of file
+  ~Partition();                 // destroy partitions
 
 private:
-  int P;            // number of partitions
-  string *partName; // partition names
+  int P;             // number of partitions
+  SpillFile **parts; // partition files
 };
 
 #endif
@@ -1,9 +1,19 @@
 #ifndef QUERY_H
 #define QUERY_H
 
+#include <map>
 #include "heapfile.h"
 
-enum JoinType { NLJoin, SMJoin, HashJoin };
+// join method forced on the command line, CostJoin to choose one by
+// estimated cost for every join
+enum JoinType { NLJoin, SMJoin, HashJoin, CostJoin };
+
+// number of threads used by parallel operators (set in minirel.C)
+extern int NumWorkers;
+
+// relations with fewer pages than this are always scanned serially
+const int PARALLEL_MINPAGES = 32;
+const int MAXWORKERS = 32;
 
 //
 // Prototypes for query layer functions
@@ -13,10 +23,53 @@ const Status QU_Select(const string &result, const int projCnt,
                        const attrInfo projNames[], const attrInfo *attr,
                        const Operator op, const char *attrValue);
 
+// selection on the predCnt predicates preds[i] ops[i] preds[i].attrValue,
+// all of which (any of which if disjunctive) a tuple must satisfy
+const Status QU_Select(const string &result, const int projCnt,
+                       const attrInfo projNames[], const int predCnt,
+                       const attrInfo preds[], const Operator ops[],
+                       const bool disjunctive);
+
 const Status QU_Join(const string &result, const int projCnt,
                      const attrInfo projNames[], const attrInfo *attr1,
                      const Operator op, const attrInfo *attr2);
 
+// join of all relations named in the joinCnt join predicates
+// joinAttrs1[i] joinOps[i] joinAttrs2[i], restricted by the predCnt
+// selection predicates preds[i] predOps[i] preds[i].attrValue; a
+// relation joined with itself is named by aliases mapped to it
+const Status QU_Join(const string &result, const int projCnt,
+                     const attrInfo projNames[], const int joinCnt,
+                     const attrInfo joinAttrs1[], const Operator joinOps[],
+                     const attrInfo joinAttrs2[], const int predCnt,
+                     const attrInfo preds[], const Operator predOps[],
+                     const map<string, string> &aliases =
+                         map<string, string>());
+
+// the tuples of the relation of attr in the order of attr, largest
+// first if descending, the first limit of them unless limit is negative
+const Status QU_Order(const string &result, const int projCnt,
+                      const attrInfo projNames[], const attrInfo *attr,
+                      const bool descending, const int limit);
+
+// aggregate functions; NoAggr marks an attribute grouped on
+enum AggrFunc { NoAggr, CountAggr, SumAggr, AvgAggr, MinAggr, MaxAggr };
+
+// grouping of the relation of projNames on the groupCnt attributes
+// groupAttrs, each group giving a tuple of the projCnt attributes
+// projNames[i] aggregated by funcs[i]; attrName is empty for COUNT(*)
+const Status QU_Aggregate(const string &result, const int projCnt,
+                          const attrInfo projNames[], const AggrFunc funcs[],
+                          const int groupCnt, const attrInfo groupAttrs[]);
+
+// the distinct tuples of the relation of projNames projected on them
+const Status QU_Distinct(const string &result, const int projCnt,
+                         const attrInfo projNames[]);
+
+// type and length of the values of aggregate func over attr
+const Status AggregateType(const AggrFunc func, const attrInfo *attr,
+                           int &type, int &len);
+
 const Status QU_Insert(const string &relation, const int attrCnt,
                        const attrInfo attrList[]);
 
@@ -1,20 +1,32 @@
 #ifndef SORT_H
 #define SORT_H
 
+#include <stdint.h>
+#include <atomic>
 #include "heapfile.h"
+#include "spill.h"
 
 // define if debug output wanted
 // #define DEBUGSORT
 
-// SORTREC is an in-memory sort record that qsort(3) sorts.
-// The sort attribute as well as the associated RID are
-// stored in the record. The RID is used for fetching the
-// full record when it is needed.
+// number of runs a merge reads at once, each through a block of
+// SPILLBLOCK bytes
+const int SORTFANIN = 32;
+
+// SORTREC is an in-memory sort record that sortBuffer() sorts.
+// The tuples of a run are packed one after another into the
+// workspace of the SortedFile; a sort record points to the sort
+// attribute of its tuple there and locates the tuple for writing
+// it out to the run.
 
 typedef struct {
-  RID rid;     // record id of current record
-  char *field; // pointer to field
-  int length;  // length of field
+  uint64_t key;  // normalized key of field, in sort order
+  char *field;   // pointer to field
+  int length;    // length of field
+  int recOffset; // offset of tuple in workspace
+  int recLength; // length of tuple
+  int runNo;     // run of tuple (replacement selection)
+  int seqNo;     // order tuple was read in (replacement selection)
 } SORTREC;
 
 class SortedFile {
@@ -22,7 +34,11 @@ public:
   SortedFile(const string &fileName,
              int offset,                // sort source file on the given
              int length, Datatype type, // attribute
-             int maxItems, Status &status);
+             int maxItems, Status &status,
+             bool replacement = false, // runs by replacement selection
+             bool descending = false,  // largest value first
+             bool ridTies = false);    // equal values in order of the
+                                       // RID after the attribute
 
   Status next(Record &rec); // fetch next record in sort order
   Status setMark();         // record a position in sort sequence
@@ -30,30 +46,70 @@ public:
   ~SortedFile();            // destroy temporary structures / files
 
 private:
-  Status sortFile();                // split source file into sub-runs
-  Status generateRun(int numItems); // generate one sub-run of file
-  Status startScans();              // start a scan on each sorted run
-
   typedef struct {
-    string name;             // name of run file
-    HeapFileScan *inFile;    // ptr to input file
-    InsertFileScan *outFile; // ptr to output file
-    int valid;               // TRUE if recPtr has a record
+    string name;        // name of run, for debugging output
+    SpillFile *file;    // ptr to file holding the run
+    SpillScan *inFile;  // ptr to scan reading the run
+    int valid;          // TRUE if recPtr has a record
     Record rec;
-    RID rid; // RID of current record of run
-    RID mark;
+    int recNo; // number of current record of run, -1 past the end
+    int mark;
+    vector<char> keys; // sort key of every keyGap-th record
+    int keyGap;
   } RUN;
 
-  vector<RUN> runs; // holds info about each sub-run
+  Status sortFile();                // split source file into sub-runs
+  Status fillRuns(int workerCnt);   // sub-runs of maxItems records
+  Status selectRuns();              // sub-runs by replacement selection
+  Status createRun(RUN &run);       // create the file of a sub-run
+  Status fetchRecord(RUN &run);     // bring in next record of a run
+  Status appendRecord(RUN &run, const Record &rec); // add record to run
+  Status mergePasses(int fanIn);    // merge sub-runs down to fanIn
+  Status mergeGroup(vector<RUN> &merged); // merge runs into one
+  Status mergeRanges(int workerCnt); // merge sub-runs by key range
+  Status fillBuffer(SORTREC *recs, int items, vector<char> &space,
+                    int &numItems); // read the next records of file
+  void sortBuffer(SORTREC *recs, int items); // sort the records in recs
+  Status generateRun(SORTREC *recs, int items, vector<char> &space,
+                     RUN &run);     // generate one sub-run of file
+  void fillWorker(SORTREC *recs, int items, // thread of fillRuns()
+                  vector<pair<int, RUN>> *made, Status *result);
+  Status mergeRange(const char *lo, const char *hi, RUN &out,
+                    vector<SpillScan *> &scans); // merge one range
+  void rangeWorker(const char *lo, const char *hi, // thread of
+                   RUN *out, Status *result);      // mergeRanges()
+  Status startScans();              // start a scan on each sorted run
+  Status buildTree();               // set up the loser tree of the runs
+  int playGame(int node);           // winner of a subtree of the tree
+  bool beats(int run1, int run2);   // true if run1's record goes first
+  int compare(const char *field1, const char *field2); // in sort order
+  uint64_t sortKey(const char *field); // key sortBuffer() sorts on
+  int keycmp(const SORTREC &r1, const SORTREC &r2); // compare by keys
+
+  vector<RUN> runs;   // holds info about each sub-run
+  atomic<int> runCnt; // number of sub-runs created, for naming them
+
+  // Tournament tree over the current records of the runs: tree[0] is
+  // the run holding the smallest record, and internal node i, whose
+  // children are nodes 2i and 2i+1, holds the run that lost the match
+  // played there. Run r is leaf runs.size() + r. Empty until next()
+  // builds it, and emptied again by gotoMark().
+  vector<int> tree;
 
-  HeapFile *hfile;   // source file to sort
+  bool replacement;  // runs by replacement selection
+  bool descending;   // sorted from the largest value down
+  bool ridTies;      // equal values ordered on the RID that follows
   HeapFileScan *hfs; // source file to sort
+  int batchCnt;      // batches of records read from hfs by fillRuns()
+  mutex scanLatch;   // serializes the workers' reads of hfs
   string fileName;   // name of source file to sort
   Datatype type;     // type of sort attribute
   int offset;        // offset of sort attribute
   int length;        // length of sort attribute
+  int keyLength;     // length of sort attribute and tie-breaking RID
 
-  SORTREC *buffer; // in-memory sort buffer
+  SORTREC *buffer;        // in-memory sort buffer
+  vector<char> workspace; // tuples of the sort records in buffer
   int maxItems;    // max. # of items/tuples in buffer
   int numItems;    // current # of items in buffer
 };
@@ -0,0 +1,75 @@
+#ifndef SPILL_H
+#define SPILL_H
+
+#include "heapfile.h"
+
+// directory spill files are created in (set in minirel.C)
+extern string SpillDir;
+
+// number of bytes of records a spill file writes or reads at a time
+const int SPILLBLOCK = 32 * 1024;
+
+// A SpillFile holds records that an operator moves out of memory for
+// a while, such as the runs of a sort or the partitions of a relation.
+// It is not part of the database: it is a Unix file in SpillDir,
+// removed from the directory as soon as it is created, so that it
+// disappears when closed. Records are only appended to it, and then
+// scanned by SpillScans. All records of a spill file have the length
+// of the first one. They are packed one after another without any
+// page structure, and written and read in blocks of as many records
+// as fit into SPILLBLOCK bytes.
+
+class SpillFile {
+  friend class SpillScan;
+
+public:
+  // create an empty spill file; name tells what it holds
+  SpillFile(const string &name, Status &status);
+
+  // close the file, which removes it
+  ~SpillFile();
+
+  // add a record at the end of the file
+  const Status append(const Record &rec);
+
+  // write out the records still in memory, after which all records
+  // appended can be scanned
+  const Status flush();
+
+  // return number of records in file
+  const int getRecCnt() const;
+
+  // return number of records in a block
+  const int getBlockRecs() const;
+
+private:
+  int unixFile;       // Unix file descriptor
+  int recLen;         // length of every record, 0 while empty
+  int recCnt;         // number of records appended
+  vector<char> block; // records of the last block, not all written
+};
+
+// A SpillScan reads the records of a flushed SpillFile a block at a
+// time. Any number of scans, in different threads as well, can read
+// the same file at once.
+
+class SpillScan {
+public:
+  SpillScan(const SpillFile &file);
+
+  // return the next record and its number; the record stays in
+  // memory until the scan moves on to another block
+  const Status scanNext(int &recNo, Record &rec);
+
+  // position the scan so that recNo is the next record returned
+  const Status seek(const int recNo);
+
+private:
+  const SpillFile &file;
+  vector<char> block; // block of records in memory
+  int firstRec;       // number of first record in block
+  int blockCnt;       // number of records in block
+  int nextRec;        // number of next record to return
+};
+
+#endif
@@ -0,0 +1,47 @@
+#ifndef STATS_H
+#define STATS_H
+
+#include <stdint.h>
+#include "catalog.h"
+
+// number of bits of a hash value picking a HyperLogLog register
+const int HLLBITS = 10;
+
+// A HyperLogLog sketch estimating the number of distinct values added
+// to it in 2^HLLBITS bytes. Every value is hashed; the first HLLBITS bits
+// of the hash pick a register, which keeps the longest run of leading
+// zeros seen in the rest. The standard error of the estimate is about
+// 1.04 / sqrt(2^HLLBITS), some 3%.
+
+class HyperLogLog {
+public:
+  HyperLogLog();
+
+  // add a value in the binary form of an attribute
+  void add(const void *value, const AttrDesc &attr);
+
+  // return the estimated number of distinct values added
+  const int estimate() const;
+
+private:
+  unsigned char registers[1 << HLLBITS];
+};
+
+// compare two values in the binary form of an attribute, strings on
+// their first len bytes; returns -1, 0 or 1
+int CompareValues(const void *value1, const void *value2, const int type,
+                  const int len);
+
+// copy a value of an attribute into the STATKEYLEN byte form AttrStats
+// keeps values in
+void StatKey(char *dest, const void *value, const AttrDesc &attr);
+
+// compare two values in the form of StatKey
+int CompareStatKeys(const char *key1, const char *key2, const AttrDesc &attr);
+
+// estimated fraction of the tuples of a relation whose value of attr
+// satisfies (value) op (filter), given the statistics on attr
+const double Selectivity(const AttrStats &stats, const AttrDesc &attr,
+                         const Operator op, const void *filter);
+
+#endif
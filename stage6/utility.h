@@ -13,6 +13,8 @@
 #include <functional>
 #include "error.h"
 #include <string.h>
+#include <string>
+#include <vector>
 using namespace std;
 #include "error.h"
 
@@ -22,7 +24,10 @@ using namespace std;
 // Prototypes for utility layer functions
 //
 
-const Status UT_Load(const string &relation, const string &fileName);
+const Status UT_Load(const string &relation, const vector<string> &fileNames,
+                     const bool analyze = false);
+
+const Status UT_Analyze(const string &relation);
 
 const Status UT_Print(string relation);
 